@@ -0,0 +1,71 @@
+/*! @file Low_Power_Demo.ino
+
+@section Low_Power_Demo_intro_section Description
+
+Example for smoothLED using the Arduino built-in LED on a battery-powered device\n\n
+
+The LED fades on, stays on, fades off and stays off in a 10 second cycle. Power-save mode is off by
+default and is turned on in "setup()" using "smoothLED::powerSave()". With it on, all of the
+library's interrupts are turned off once the LED is fully ON or OFF and not fading. The "loop()"
+calls "smoothLED::sleepUntilNextTick()" so that the processor idles between interrupts instead of
+spinning, which lowers the average current draw without affecting the LED brightness.
+
+@section Low_Power_Demo_license GNU General Public License v3.0
+This program is free software: you can redistribute it and/or modify it under the terms of the GNU
+General Public License as published by the Free Software Foundation, either version 3 of the
+License, or (at your option) any later version. This program is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more details. You should have
+received a copy of the GNU General Public License along with this program.  If not, see
+<http://www.gnu.org/licenses/>.
+
+@section Low_Power_Demoauthor Author
+
+Written by Arnd <Arnd@Zanduino.Com> at https://www.github.com/SV-Zanshin
+
+@section Low_Power_Demoversions Changelog
+
+| Version| Date       | Developer  | Comments                                                      |
+| ------ | ---------- | ---------- | ------------------------------------------------------------- |
+| 1.0.0  | 2026-10-18 | SV-Zanshin | Initial coding                                                |
+*/
+
+#include "SmoothLED.h"  // Include the library
+#ifndef __AVR__
+#error This library and program is designed for Atmel ATMega processors
+#endif
+
+const uint16_t FADE_MS{2000};   //!< Milliseconds for each fade
+const uint16_t CYCLE_MS{5000};  //!< Milliseconds between changes of direction
+
+smoothLED Board;  //!< instance of smoothLED pointing to the builtin LED
+
+void setup() {
+  /*!
+      @brief    Arduino method called once at startup to initialize the system
+      @details  This is an Arduino IDE method which is called first upon boot or restart. It is only
+                called one time and then control goes to the main "loop()" method, from which
+                control never returns
+      @return   void
+  */
+  Board.begin(LED_BUILTIN);  // Initialize the built-in LED, which starts OFF
+  smoothLED::powerSave();    // Power-save mode is off by default, so turn it on
+}  // of method "setup()"
+
+void loop() {
+  /*!
+      @brief    Arduino method for the main program loop
+      @details  Main program for the Arduino IDE, it is an infinite loop and keeps on repeating.
+                Every CYCLE_MS milliseconds the LED is faded in the other direction, and in between
+                the processor sleeps until the next interrupt
+      @return   void
+  */
+  static uint32_t lastChange{0};            // millis() value of the last change in direction
+  static bool     ledOn{false};             // Set when the LED is fading or faded ON
+  if (millis() - lastChange >= CYCLE_MS) {  // If it is time to change direction
+    lastChange = millis();                  // remember when
+    ledOn      = !ledOn;                    // toggle the direction
+    Board.set(ledOn ? 1023 : 0, FADE_MS);   // and fade in the background
+  }                                         // if-then time to change
+  smoothLED::sleepUntilNextTick();          // Idle until the next interrupt
+}  // of method "loop()"
@@ -7,6 +7,8 @@ See main library header file for details
 
 #include "SmoothLED.h"
 
+#include <avr/sleep.h>
+
 #include "util/atomic.h"
 const uint16_t MAX10BIT{0x3FF};   //!< 1023 decimal - biggest value for 10 bits
 const uint8_t  FLAG_INVERTED{1};  //!< Bit mask for inverted LED flag
@@ -15,6 +17,8 @@ const uint8_t  FLAG_PWM{2};       //!< Bit mask for LED is not 0 or 1023
 smoothLED *smoothLED::_firstLink{nullptr};  // static member declaration outside of class for init
 uint16_t   smoothLED::_counterPWM{0};       // loop counter 0-1023 for software PWM
 
+volatile bool smoothLED::_powerSave{false};  // power-save mode is off by default, see powerSave()
+
 /***************************************************************************************************
 ** Not all of these macros are defined on all platforms, so redefine them here just in case       **
 ***************************************************************************************************/
@@ -133,6 +137,7 @@ smoothLED &smoothLED::operator++() {
   */
   ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {  // disable interrupts while changing 16 bit value
     ++_targetLevel &= MAX10BIT;        // increment target and clamp to range
+    wake();                            // make sure interrupts are running
   }                                    // of atomic block
   return *this;                        // Return new class value
 }
@@ -143,6 +148,7 @@ smoothLED &smoothLED::operator--() {
   */
   ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {  // disable interrupts while changing 16 bit value
     --_targetLevel &= MAX10BIT;        // decrement target and clamp to range
+    wake();                            // make sure interrupts are running
   }                                    // of atomic block
   return *this;                        // Return new class value
 }
@@ -153,6 +159,7 @@ smoothLED &smoothLED::operator+(const int16_t &value) {
   */
   ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {  // disable interrupts while changing 16 bit value
     this->_targetLevel = (this->_targetLevel + value) & MAX10BIT;  // increment target and clamp
+    wake();                                                        // make sure interrupts run
   }                                                                // of atomic block
   return *this;                                                    // Return new class value
 }
@@ -163,6 +170,7 @@ smoothLED &smoothLED::operator-(const int16_t &value) {
   */
   ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {  // disable interrupts while changing 16 bit value
     this->_targetLevel = (this->_targetLevel - value) & MAX10BIT;  // decrement target and clamp
+    wake();                                                        // make sure interrupts run
   }                                                                // of atomic block
   return *this;                                                    // Return new class value
 }
@@ -173,6 +181,7 @@ smoothLED &smoothLED::operator+=(const int16_t &value) {
 */
   ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {  // disable interrupts while changing 16 bit value
     this->_targetLevel = (this->_targetLevel + value) & MAX10BIT;  // increment target and clamp
+    wake();                                                        // make sure interrupts run
   }                                                                // of atomic block
   return *this;                                                    // Return new class value
 }
@@ -183,6 +192,7 @@ smoothLED &smoothLED::operator-=(const int16_t &value) {
 */
   ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {  // disable interrupts while changing 16 bit value
     this->_targetLevel = (this->_targetLevel - value) & MAX10BIT;  // decrement target and clamp
+    wake();                                                        // make sure interrupts run
   }                                                                // of atomic block
   return *this;                                                    // Return new class value
 }
@@ -374,12 +384,69 @@ void smoothLED::set(const uint16_t &val, const uint16_t &speed) {
     }                                 // if-then-else immediate
     if (_flags & FLAG_PWM) {          // If PWM is needed, then
       _counterPWM = 0;                // start counter at beginning
+      wake();                         // and turn on the TIMER0 and TIMER1 interrupts
+    }                                 // if-then PWM needed
+  }                                   // of atomic block
+}  // of function "set()"
+void smoothLED::wake() {
+  /*!
+  @brief   Turn on PWM and fading for this LED
+  @details Sets the PWM flag and enables the TIMER1 PWM interrupt along with the TIMER0 COMPA and
+           COMPB fader interrupts, since these might have been turned off by "faderISR()" when no
+           pins needed them. Must be called with interrupts disabled.
+  @return  void returns nothing
+*/
+  if (_portRegister == nullptr) return;  // Skip processing if the pin is not initialized
+  _flags |= FLAG_PWM;                    // Let faderISR() decide when PWM is no longer needed
 #if defined(OCR1AL)
-      TIMSK1 |= _BV(OCIE1A);  // Set interrupt on Match A for TIMER1
+  TIMSK1 |= _BV(OCIE1A);  // Set interrupt on Match A for TIMER1
 #endif
-    }  // if-then PWM needed
+#if defined(TIMSK0)
+  TIMSK0 |= _BV(OCIE0A) | _BV(OCIE0B);  // TIMER0_COMPA and TIMER0_COMPB for fading
+#elif defined(TIMSK)
+  TIMSK |= _BV(OCIE0A) | _BV(OCIE0B);  // TIMER0_COMPA and TIMER0_COMPB (ATtiny25-45-85)
+#endif
+}  // of function "wake()"
+void smoothLED::powerSave(const bool on) {
+  /*!
+  @brief     Turn power-save mode on or off
+  @details   Normally only the TIMER1 PWM interrupt is turned off when all LEDs are either fully ON
+             or OFF, while the TIMER0 COMPA and COMPB fader interrupts keep firing 2000 times a
+             second. With power-save mode on, "faderISR()" turns off those interrupts as well once
+             nothing is fading and no pin needs PWM, so that the processor can stay asleep when
+             "sleepUntilNextTick()" is used. Any "set()" call or operator change turns them back on.
+  @param[in] on     Boolean - true turns power-save mode on, false turns it off. Defaults to true
+*/
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {    // disable interrupts in block
+    _powerSave = on;                     // set the static flag
+    if (!on && _firstLink != nullptr) {  // If turning off and instances exist, then
+#if defined(TIMSK0)
+      TIMSK0 |= _BV(OCIE0A) | _BV(OCIE0B);  // turn the fader interrupts back on
+#elif defined(TIMSK)
+      TIMSK |= _BV(OCIE0A) | _BV(OCIE0B);  // turn the fader interrupts back on (ATtiny25-45-85)
+#endif
+    }  // if-then turning off power-save
   }    // of atomic block
-}  // of function "set()"
+}  // of function "powerSave()"
+void smoothLED::sleepUntilNextTick() {
+  /*!
+  @brief   Put the processor into idle sleep until the next interrupt
+  @details Idle sleep stops the CPU clock but leaves the timers running, so the PWM and fading
+           interrupts keep their exact timing and brightness is unaffected. The processor wakes up
+           on the next interrupt, either one of this library's or the Arduino TIMER0 overflow used
+           for "millis()", and returns to the sketch after that interrupt has been serviced. Calling
+           this in the sketch's "loop()" lets the processor sleep between PWM interrupts. Interrupts
+           are disabled while preparing so that no interrupt is missed before the "sleep"
+           instruction, which always executes before the pending interrupt is serviced.
+  @return  void returns nothing
+*/
+  set_sleep_mode(SLEEP_MODE_IDLE);  // Idle keeps all timers running
+  cli();                            // disable interrupts while preparing to sleep
+  sleep_enable();                   // set the sleep enable bit
+  sei();                            // enable interrupts, next instruction is always executed
+  sleep_cpu();                      // sleep until the next interrupt
+  sleep_disable();                  // clear the sleep enable bit after waking
+}  // of function "sleepUntilNextTick()"
 void smoothLED::pwmISR() {
   /*!
   @brief     Function to actually perform the PWM on all pins
@@ -461,9 +528,18 @@ void smoothLED::faderISR() {
   }                                           // of while loop to traverse  list
   /*************************************************************************************************
   ** If no pins in our class instances are using PWM,  then we can save lots of CPU cycles by     **
-  ** disabling the TIMER1 interrupt. Interrupts are re-enabled in the "set()" function            **
+  ** disabling the TIMER1 interrupt. Since the PWM flag stays set while a pin is fading, this     **
+  ** also means that nothing is fading so in power-save mode the TIMER0 COMPA and COMPB fader     **
+  ** interrupts are disabled as well. Interrupts are re-enabled in the "wake()" function          **
   *************************************************************************************************/
   if (noPWM) {               // If no pins are using PWM
     TIMSK1 &= ~_BV(OCIE1A);  // Unset interrupt on Match A
-  }                          // if-then no pins are using PWM
+    if (_powerSave) {        // If in power-save mode
+#if defined(TIMSK0)
+      TIMSK0 &= ~(_BV(OCIE0A) | _BV(OCIE0B));  // Unset TIMER0_COMPA and TIMER0_COMPB
+#elif defined(TIMSK)
+      TIMSK &= ~(_BV(OCIE0A) | _BV(OCIE0B));  // Unset TIMER0_COMPA and TIMER0_COMPB (ATtiny)
+#endif
+    }  // if-then power-save mode
+  }    // if-then no pins are using PWM
 }  // of function "faderISR()"
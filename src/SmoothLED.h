@@ -53,6 +53,7 @@ Written by Arnd <Arnd@Zanduino.Com> at https://www.github.com/SV-Zanshin
 
 | Version| Date       | Developer  | Comments                                                      |
 | ------ | ---------- | ---------- | ------------------------------------------------------------- |
+| 1.0.3  | 2026-10-18 | SV-Zanshin | Added powerSave() and sleepUntilNextTick() for low-power use  |
 | 1.0.2  | 2021-01-21 | SV-Zanshin | Issue #2 - use base-2 rather than base-10 for fading          |
 | 1.0.2  | 2021-01-20 | SV-Zanshin | Reset _counterPWM when turning PWM on to remove quick flash   |
 | 1.0.2  | 2021-01-19 | SV-Zanshin | Issue #1 - check for valid Hertz parameter setting            |
@@ -179,21 +180,25 @@ class smoothLED {
   void        hertz(const uint8_t hertz) const;   // Set hertz rate for PWM
   static void pwmISR();                           // Actual PWM function
   static void faderISR();                         // Actual fader function
+  static void powerSave(const bool on = true);    // Stop all interrupts when LEDs are static
+  static void sleepUntilNextTick();               // Idle sleep until the next interrupt
   void        set(const uint16_t& val,            // Set a pin's value
                   const uint16_t& speed = 0);     // optional change speed in milliseconds
  private:                                         // declare the private class members
-  static smoothLED* _firstLink;                   //!< Static pointer to first instance in list
-  static uint16_t   _counterPWM;                  //!< loop counter 0-1023 for software PWM
-  volatile uint8_t* _portRegister{nullptr};       //!< Pointer to the actual PORT{n} Register
-  smoothLED*        _nextLink{nullptr};           //!< Pointer to the next instance in  list
-  uint8_t           _registerBitMask{0};          //!< bit mask for the bit used in PORT{n}
-  volatile uint16_t _currentLevel{0};             //!< Current PWM level 0-1023
-  volatile uint16_t _currentCIE{0};               //!< Current PWM level from cie table
-  uint16_t          _targetLevel{0};              //!< Target PWM level 0-1023
-  volatile uint8_t  _flags{0};                    //!< Status bits, see cpp file for details
-  uint16_t          _changeDelays{0};             //!< Variable storing delay time for fades
-  volatile int16_t  _changeTicker{0};             //!< Countdown timer used in fading
-  inline void       pinOn() const __attribute__((always_inline));   // Turn LED on
-  inline void       pinOff() const __attribute__((always_inline));  // Turn LED off
+  static smoothLED*    _firstLink;                //!< Static pointer to first instance in list
+  static uint16_t      _counterPWM;               //!< loop counter 0-1023 for software PWM
+  static volatile bool _powerSave;                //!< Set when power-save mode is active
+  volatile uint8_t*    _portRegister{nullptr};    //!< Pointer to the actual PORT{n} Register
+  smoothLED*           _nextLink{nullptr};        //!< Pointer to the next instance in  list
+  uint8_t              _registerBitMask{0};       //!< bit mask for the bit used in PORT{n}
+  volatile uint16_t    _currentLevel{0};          //!< Current PWM level 0-1023
+  volatile uint16_t    _currentCIE{0};            //!< Current PWM level from cie table
+  uint16_t             _targetLevel{0};           //!< Target PWM level 0-1023
+  volatile uint8_t     _flags{0};                 //!< Status bits, see cpp file for details
+  uint16_t             _changeDelays{0};          //!< Variable storing delay time for fades
+  volatile int16_t     _changeTicker{0};          //!< Countdown timer used in fading
+  inline void          pinOn() const __attribute__((always_inline));   // Turn LED on
+  inline void          pinOff() const __attribute__((always_inline));  // Turn LED off
+  void                 wake();                                         // Re-enable interrupts
 };  // of class smoothLED                                           //
 #endif